@@ -0,0 +1,123 @@
+#!/usr/bin/env python3
+"""
+Compare two benchmark baselines and flag regressions.
+
+Matches runs between the two baselines by (case, refine, ranks) and compares
+the wall-clock time and the per-subsystem profile timings. A metric that got
+slower by more than the threshold is a regression; the exit code is non-zero
+if any regression is found, so this can gate CI.
+
+Usage:
+    python3 scripts/benchmark/compare_benchmarks.py old.json new.json \\
+        [--threshold PCT] [--section-threshold PCT] [--min-time SECONDS]
+
+Options:
+    --threshold          Allowed slowdown of the total wall/clock time in
+                         percent before it counts as a regression (default 10)
+    --section-threshold  Allowed slowdown of an individual profile section
+                         (default: same as --threshold; sections are noisier)
+    --min-time           Ignore sections faster than this in both baselines;
+                         sub-second sections are dominated by noise
+                         (default 0.5 s)
+"""
+
+import argparse
+import json
+import sys
+from pathlib import Path
+
+
+def run_key(run):
+    return (run["case"], run["refine"], run["ranks"])
+
+
+def fmt_key(key):
+    return f"{key[0]} refine={key[1]} np={key[2]}"
+
+
+def compare_value(label, old, new, threshold, report):
+    """Append a comparison line to report; return True on regression."""
+    if old <= 0:
+        return False
+    change = 100.0 * (new - old) / old
+    marker = " "
+    regression = False
+    if change > threshold:
+        marker = "✗"
+        regression = True
+    elif change < -threshold:
+        marker = "+"
+    report.append(
+        f"  {marker} {label:<40s} {old:10.3f} -> {new:10.3f} s "
+        f"({change:+6.1f}%)")
+    return regression
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Compare two benchmark baselines")
+    parser.add_argument("old", type=Path)
+    parser.add_argument("new", type=Path)
+    parser.add_argument("--threshold", type=float, default=10.0)
+    parser.add_argument("--section-threshold", type=float, default=None)
+    parser.add_argument("--min-time", type=float, default=0.5)
+    args = parser.parse_args()
+
+    if args.section_threshold is None:
+        args.section_threshold = args.threshold
+
+    old_runs = {run_key(r): r for r in json.loads(args.old.read_text())["runs"]}
+    new_runs = {run_key(r): r for r in json.loads(args.new.read_text())["runs"]}
+
+    n_regressions = 0
+    n_compared = 0
+
+    for key in sorted(old_runs):
+        if key not in new_runs:
+            print(f"⚠ {fmt_key(key)}: missing from {args.new}")
+            continue
+        old, new = old_runs[key], new_runs[key]
+        n_compared += 1
+
+        report = []
+        regressed = False
+
+        for metric in ("wallTime", "clockTime", "executionTime"):
+            if metric in old and metric in new:
+                regressed |= compare_value(
+                    metric, old[metric], new[metric], args.threshold, report)
+
+        for section in sorted(old.get("sections", {})):
+            if section not in new.get("sections", {}):
+                continue
+            o = old["sections"][section]
+            n = new["sections"][section]
+            if o["avg"] < args.min_time and n["avg"] < args.min_time:
+                continue
+            regressed |= compare_value(
+                section, o["avg"], n["avg"], args.section_threshold, report)
+
+        old_iters = old.get("fluidIterations", {})
+        new_iters = new.get("fluidIterations", {})
+        for region in sorted(old_iters):
+            if region in new_iters and new_iters[region] != old_iters[region]:
+                report.append(
+                    f"  ⚠ {region + '/fluidIterations':<40s} "
+                    f"{old_iters[region]:10d} -> {new_iters[region]:10d}")
+
+        status = "REGRESSION" if regressed else "ok"
+        print(f"\n{fmt_key(key)}: {status}")
+        for line in report:
+            print(line)
+        if regressed:
+            n_regressions += 1
+
+    for key in sorted(set(new_runs) - set(old_runs)):
+        print(f"\n{fmt_key(key)}: new (no reference)")
+
+    print(f"\n{n_compared} run(s) compared, {n_regressions} regression(s)")
+    sys.exit(1 if n_regressions else 0)
+
+
+if __name__ == "__main__":
+    main()
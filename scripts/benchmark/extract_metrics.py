@@ -0,0 +1,147 @@
+#!/usr/bin/env python3
+"""
+Extract performance metrics from a benchmark run into JSON.
+
+Collects, for a completed solver run:
+  - wall-clock and solver-reported execution/clock time,
+  - per-subsystem timings from the solver profile
+    (postProcessing/solverProfile/profile.dat, written by the solver at
+    every write interval: time section avg min max count),
+  - SIMPLE/Picard iteration counts per region from the profile counters
+    and the "region solution ended in N iterations" log lines.
+
+Usage (single run, called by run_benchmarks.sh):
+    extract_metrics.py --case NAME --refine L --ranks N --steps S \\
+        --wall-time T --log LOGFILE --case-dir DIR -o fragment.json
+
+Usage (merge fragments into a baseline):
+    extract_metrics.py --merge FRAGMENT_DIR -o baseline.json
+"""
+
+import argparse
+import datetime
+import json
+import platform
+import re
+import sys
+from pathlib import Path
+
+EXEC_TIME_RE = re.compile(
+    r'ExecutionTime = ([\d.e+-]+) s\s+ClockTime = ([\d.e+-]+) s')
+ITERATIONS_RE = re.compile(
+    r'^(\S+) region solution ended in (\d+) iterations', re.MULTILINE)
+
+
+def parse_log(log_path):
+    """Solver-reported times and per-region fluid iteration counts."""
+    text = Path(log_path).read_text(errors="replace")
+
+    metrics = {}
+    times = EXEC_TIME_RE.findall(text)
+    if times:
+        metrics["executionTime"] = float(times[-1][0])
+        metrics["clockTime"] = float(times[-1][1])
+
+    iterations = {}
+    for region, n in ITERATIONS_RE.findall(text):
+        iterations[region] = iterations.get(region, 0) + int(n)
+    if iterations:
+        metrics["fluidIterations"] = iterations
+
+    return metrics
+
+
+def parse_profile(case_dir):
+    """Per-subsystem timings from the last solver profile report."""
+    profile = Path(case_dir) / "postProcessing" / "solverProfile" / "profile.dat"
+    if not profile.is_file():
+        return {}
+
+    rows = []
+    for line in profile.read_text().splitlines():
+        if not line or line.startswith("#"):
+            continue
+        parts = line.split()
+        if len(parts) != 6:
+            continue
+        rows.append(parts)
+    if not rows:
+        return {}
+
+    # the profile accumulates over the run; the last report covers it all
+    last_time = rows[-1][0]
+    sections = {}
+    for time, section, avg, vmin, vmax, count in rows:
+        if time != last_time:
+            continue
+        sections[section] = {
+            "avg": float(avg),
+            "min": float(vmin),
+            "max": float(vmax),
+            "count": int(count),
+        }
+    return sections
+
+
+def extract(args):
+    run = {
+        "case": args.case,
+        "refine": int(args.refine),
+        "ranks": int(args.ranks),
+        "steps": int(args.steps),
+        "wallTime": float(args.wall_time),
+    }
+    run.update(parse_log(args.log))
+    sections = parse_profile(args.case_dir)
+    if sections:
+        run["sections"] = sections
+    else:
+        print(f"Warning: no solver profile found under {args.case_dir}",
+              file=sys.stderr)
+
+    Path(args.output).write_text(json.dumps(run, indent=2) + "\n")
+
+
+def merge(args):
+    fragments = sorted(Path(args.merge).glob("*.json"))
+    runs = [json.loads(f.read_text()) for f in fragments]
+
+    baseline = {
+        "meta": {
+            "date": datetime.datetime.now().isoformat(timespec="seconds"),
+            "host": platform.node(),
+            "nRuns": len(runs),
+        },
+        "runs": runs,
+    }
+    out = Path(args.output)
+    out.parent.mkdir(parents=True, exist_ok=True)
+    out.write_text(json.dumps(baseline, indent=2) + "\n")
+    print(f"Merged {len(runs)} run(s) into {out}")
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Extract benchmark metrics into JSON")
+    parser.add_argument("--case")
+    parser.add_argument("--refine", default=1)
+    parser.add_argument("--ranks", default=1)
+    parser.add_argument("--steps", default=0)
+    parser.add_argument("--wall-time", default=0.0)
+    parser.add_argument("--log")
+    parser.add_argument("--case-dir")
+    parser.add_argument("--merge", metavar="FRAGMENT_DIR")
+    parser.add_argument("-o", "--output", required=True)
+    args = parser.parse_args()
+
+    if args.merge:
+        merge(args)
+    else:
+        if not (args.case and args.log and args.case_dir):
+            parser.error("--case, --log and --case-dir are required "
+                         "when not merging")
+        extract(args)
+
+
+if __name__ == "__main__":
+    main()
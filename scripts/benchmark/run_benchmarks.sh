@@ -0,0 +1,252 @@
+#!/usr/bin/env bash
+#
+# Reproducible performance benchmark suite for urbanMicroclimateFoam.
+#
+# Runs scaled variants of the reference cases (mesh refinement levels x
+# MPI rank counts) for a fixed number of time steps, extracts per-subsystem
+# timings (from the solver profile, see postProcessing/solverProfile) and
+# iteration counts, and writes a JSON baseline that compare_benchmarks.py
+# can diff against a previous run.
+#
+# Usage:
+#   ./scripts/benchmark/run_benchmarks.sh [options]
+#
+# Options:
+#   -c, --cases LIST     Comma-separated case list
+#                        (default: cases/streetCanyon_CFDHAM,cases/windAroundBuildings_CFDHAM_veg)
+#   -r, --ranks LIST     Comma-separated rank counts (default: 1,2,4,8)
+#   -m, --refine LIST    Comma-separated mesh refinement levels; each level
+#                        multiplies the blockMeshDict cell counts in every
+#                        direction (default: 1)
+#   -s, --steps N        Number of solver time steps per run (default: 3)
+#   -o, --output FILE    Baseline JSON output
+#                        (default: benchmarks/baseline_<date>.json)
+#   -k, --keep           Keep the per-run work directories under benchmarks/work
+#   -h, --help           Show this help
+#
+# Typical workflow:
+#   ./scripts/benchmark/run_benchmarks.sh -o benchmarks/baseline_old.json
+#   <apply optimization, rebuild>
+#   ./scripts/benchmark/run_benchmarks.sh -o benchmarks/baseline_new.json
+#   python3 scripts/benchmark/compare_benchmarks.py \
+#       benchmarks/baseline_old.json benchmarks/baseline_new.json --threshold 5
+
+set -eo pipefail
+
+print_usage() {
+  sed -n '2,30p' "${BASH_SOURCE[0]}" | sed 's/^# \{0,1\}//'
+}
+
+CASES="cases/streetCanyon_CFDHAM,cases/windAroundBuildings_CFDHAM_veg"
+RANKS="1,2,4,8"
+REFINE="1"
+NSTEPS=3
+OUTPUT=""
+KEEP=0
+
+while [[ $# -gt 0 ]]; do
+  case "$1" in
+    -c|--cases)  CASES="$2";  shift 2 ;;
+    -r|--ranks)  RANKS="$2";  shift 2 ;;
+    -m|--refine) REFINE="$2"; shift 2 ;;
+    -s|--steps)  NSTEPS="$2"; shift 2 ;;
+    -o|--output) OUTPUT="$2"; shift 2 ;;
+    -k|--keep)   KEEP=1;      shift ;;
+    -h|--help)   print_usage; exit 0 ;;
+    *)
+      echo "Unknown option: $1" >&2
+      print_usage
+      exit 1
+      ;;
+  esac
+done
+
+REPO_ROOT="$(cd "$(dirname "${BASH_SOURCE[0]}")/../.." && pwd)"
+BENCH_DIR="${REPO_ROOT}/benchmarks"
+WORK_ROOT="${BENCH_DIR}/work"
+FRAG_DIR="${WORK_ROOT}/fragments"
+[[ -z "$OUTPUT" ]] && OUTPUT="benchmarks/baseline_$(date +%Y%m%d_%H%M%S).json"
+
+# Detect if running in Docker; if not, re-run inside the dev container
+# (same pattern as scripts/run_case.sh)
+if [ -f /.dockerenv ] || grep -Eq '/(lxc|docker)/[[:alnum:]]{64}' /proc/self/cgroup 2>/dev/null; then
+  RUN_IN_DOCKER=true
+else
+  RUN_IN_DOCKER=false
+fi
+
+if [ "$RUN_IN_DOCKER" = false ]; then
+  DOCKER_CMD="bash scripts/benchmark/run_benchmarks.sh -c ${CASES} -r ${RANKS} -m ${REFINE} -s ${NSTEPS} -o ${OUTPUT}"
+  [[ $KEEP -eq 1 ]] && DOCKER_CMD+=" -k"
+  docker compose run --rm dev bash -c "
+    set +u && source /opt/openfoam8/etc/bashrc && set -u
+    cd /workspace
+    $DOCKER_CMD
+  "
+  exit $?
+fi
+
+# OpenFOAM bashrc can return non-zero from diagnostic pipelines
+set +e
+set +o pipefail
+source /opt/openfoam8/etc/bashrc
+set -e
+set -o pipefail
+
+export PATH=$FOAM_USER_APPBIN:$PATH
+
+rm -rf "$FRAG_DIR"
+mkdir -p "$FRAG_DIR"
+
+# Run the solar/radiation preprocessing utilities listed in the case's own
+# Allrun script (they differ per case: region names, calcLAI for vegetation)
+run_preprocessing()
+{
+  local casedir="$1"
+  local np="$2"
+  grep -E '^\s*runApplication (faceAgglomerate|viewFactorsGen|solarRayTracingGen|calcLAI)' \
+      "${casedir}/Allrun" | sed 's/^\s*runApplication\s*//' \
+  | while read -r tool args; do
+      echo "  Preprocessing: ${tool} ${args}"
+      if [[ "$np" -gt 1 ]]; then
+        mpirun -np "$np" "$tool" $args -parallel > "${casedir}/log.bench.${tool}" 2>&1
+      else
+        "$tool" $args > "${casedir}/log.bench.${tool}" 2>&1
+      fi
+    done
+}
+
+write_decompose_dict()
+{
+  local casedir="$1"
+  local np="$2"
+  cat > "${casedir}/system/decomposeParDict" <<EOFDICT
+FoamFile
+{
+    version     2.0;
+    format      ascii;
+    class       dictionary;
+    object      decomposeParDict;
+}
+numberOfSubdomains ${np};
+method          scotch;
+EOFDICT
+}
+
+run_failed=0
+
+for CASE_PATH in ${CASES//,/ }; do
+  CASE_NAME="$(basename "$CASE_PATH")"
+
+  if [[ ! -d "${REPO_ROOT}/${CASE_PATH}" ]]; then
+    echo "✗ Case '${CASE_PATH}' not found, skipping"
+    run_failed=1
+    continue
+  fi
+
+  SOLVER=$(grep "^application" "${REPO_ROOT}/${CASE_PATH}/system/controlDict" \
+           | awk '{print $2}' | tr -d ';')
+
+  for LEVEL in ${REFINE//,/ }; do
+    WORK="${WORK_ROOT}/${CASE_NAME}_refine${LEVEL}"
+    echo ""
+    echo "============================================================"
+    echo "Preparing ${CASE_NAME}, refinement level ${LEVEL}"
+    echo "============================================================"
+
+    rm -rf "$WORK"
+    mkdir -p "$(dirname "$WORK")"
+    cp -r "${REPO_ROOT}/${CASE_PATH}" "$WORK"
+
+    # Scale the background mesh resolution; snappyHexMesh/extrudeMesh
+    # refinement follows the background
+    if [[ "$LEVEL" != "1" ]]; then
+      python3 "${REPO_ROOT}/scripts/benchmark/scale_mesh.py" "$WORK" "$LEVEL"
+    fi
+
+    # Fixed number of time steps, one solver profile report at the end
+    DELTA_T=$(grep "^deltaT" "${WORK}/system/controlDict" | awk '{print $2}' | tr -d ';')
+    END_TIME=$(python3 -c "print(${NSTEPS}*${DELTA_T})")
+    sed -i "s/^startFrom .*/startFrom       startTime;/" "${WORK}/system/controlDict"
+    sed -i "s/^startTime .*/startTime       0;/" "${WORK}/system/controlDict"
+    sed -i "s/^endTime .*/endTime         ${END_TIME};/" "${WORK}/system/controlDict"
+    sed -i "s/^writeInterval .*/writeInterval   ${NSTEPS};/" "${WORK}/system/controlDict"
+
+    echo "Meshing (Allprepare)..."
+    ( cd "$WORK" && ./Allprepare > log.bench.Allprepare 2>&1 ) || {
+      echo "✗ Allprepare FAILED for ${CASE_NAME} refine=${LEVEL}"
+      tail -20 "${WORK}/log.bench.Allprepare" || true
+      run_failed=1
+      continue
+    }
+
+    for NP in ${RANKS//,/ }; do
+      RUN_ID="${CASE_NAME}_refine${LEVEL}_np${NP}"
+      echo ""
+      echo "--- ${RUN_ID}: ${NSTEPS} time steps on ${NP} rank(s) ---"
+
+      # Decomposition and preprocessing are redone per rank count; the
+      # coupling maps and view factors are decomposition-dependent
+      rm -rf "${WORK}"/processor* "${WORK}/postProcessing"
+      find "$WORK" -maxdepth 1 -regex '.*/[0-9]+\(\.[0-9]+\)?' \
+          ! -name 0 -exec rm -rf {} + 2>/dev/null || true
+
+      if [[ "$NP" -gt 1 ]]; then
+        write_decompose_dict "$WORK" "$NP"
+        ( cd "$WORK" && decomposePar -allRegions -force > log.bench.decomposePar 2>&1 ) || {
+          echo "✗ decomposePar FAILED for ${RUN_ID}"
+          run_failed=1
+          continue
+        }
+      fi
+
+      ( cd "$WORK" && run_preprocessing "$WORK" "$NP" ) || {
+        echo "✗ Preprocessing FAILED for ${RUN_ID}"
+        run_failed=1
+        continue
+      }
+
+      SOLVER_LOG="${WORK}/log.bench.${SOLVER}.np${NP}"
+      START=$(date +%s.%N)
+      if [[ "$NP" -gt 1 ]]; then
+        ( cd "$WORK" && mpirun -np "$NP" "$SOLVER" -parallel > "$SOLVER_LOG" 2>&1 ) || {
+          echo "✗ Solver FAILED for ${RUN_ID}"
+          tail -20 "$SOLVER_LOG"
+          run_failed=1
+          continue
+        }
+      else
+        ( cd "$WORK" && "$SOLVER" > "$SOLVER_LOG" 2>&1 ) || {
+          echo "✗ Solver FAILED for ${RUN_ID}"
+          tail -20 "$SOLVER_LOG"
+          run_failed=1
+          continue
+        }
+      fi
+      ELAPSED=$(python3 -c "print($(date +%s.%N) - ${START})")
+      echo "✓ Solver completed in ${ELAPSED} s"
+
+      python3 "${REPO_ROOT}/scripts/benchmark/extract_metrics.py" \
+          --case "$CASE_NAME" --refine "$LEVEL" --ranks "$NP" \
+          --steps "$NSTEPS" --wall-time "$ELAPSED" \
+          --log "$SOLVER_LOG" --case-dir "$WORK" \
+          -o "${FRAG_DIR}/${RUN_ID}.json"
+    done
+
+    [[ $KEEP -eq 0 ]] && rm -rf "$WORK"
+  done
+done
+
+# Merge the per-run fragments into one baseline
+python3 "${REPO_ROOT}/scripts/benchmark/extract_metrics.py" \
+    --merge "$FRAG_DIR" -o "${REPO_ROOT}/${OUTPUT}"
+[[ $KEEP -eq 0 ]] && rm -rf "$WORK_ROOT"
+
+echo ""
+echo "============================================================"
+echo "Baseline written to ${OUTPUT}"
+echo "Compare against a previous baseline with:"
+echo "  python3 scripts/benchmark/compare_benchmarks.py <old.json> ${OUTPUT}"
+echo "============================================================"
+
+exit $run_failed
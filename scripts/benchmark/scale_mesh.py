@@ -0,0 +1,69 @@
+#!/usr/bin/env python3
+"""
+Scale the background mesh resolution of a case for benchmarking.
+
+Multiplies the cell counts of every hex block in every blockMeshDict found
+under the case directory by the given refinement level (per direction, so
+level 2 gives 8x the cells). snappyHexMesh and extrudeMesh refinement is
+relative to the background mesh and follows automatically.
+
+Usage:
+    python3 scripts/benchmark/scale_mesh.py <case-dir> <level>
+"""
+
+import re
+import sys
+from pathlib import Path
+
+
+def scale_block_mesh_dict(path, level):
+    """Multiply the (nx ny nz) cell counts of each hex block by level."""
+    text = path.read_text()
+
+    # hex (v0 v1 ... v7) [zoneName] (nx ny nz) ...
+    pattern = re.compile(
+        r'(hex\s*\([^)]*\)\s*(?:\w+\s*)?\(\s*)'
+        r'(\d+)(\s+)(\d+)(\s+)(\d+)(\s*\))'
+    )
+
+    def repl(m):
+        nx, ny, nz = (int(m.group(i)) * level for i in (2, 4, 6))
+        return (m.group(1) + str(nx) + m.group(3) + str(ny)
+                + m.group(5) + str(nz) + m.group(7))
+
+    new_text, n = pattern.subn(repl, text)
+    if n > 0:
+        path.write_text(new_text)
+    return n
+
+
+def main():
+    if len(sys.argv) != 3:
+        print(__doc__)
+        sys.exit(1)
+
+    case_dir = Path(sys.argv[1])
+    level = int(sys.argv[2])
+
+    if not case_dir.is_dir():
+        print(f"Error: case directory '{case_dir}' not found", file=sys.stderr)
+        sys.exit(1)
+    if level < 1:
+        print("Error: refinement level must be >= 1", file=sys.stderr)
+        sys.exit(1)
+
+    n_dicts = 0
+    n_blocks = 0
+    for dict_path in sorted(case_dir.rglob("blockMeshDict")):
+        n = scale_block_mesh_dict(dict_path, level)
+        if n > 0:
+            n_dicts += 1
+            n_blocks += n
+            print(f"  Scaled {n} block(s) in {dict_path.relative_to(case_dir)}")
+
+    if n_dicts == 0:
+        print(f"Warning: no hex blocks found under '{case_dir}'", file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()